@@ -2,6 +2,19 @@
 #include <string>
 #include <vector>
 #include <queue>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 using namespace std;
 
@@ -21,6 +34,9 @@ public:
 	// almacena el grado de entrada de un vrtice
 	vector<int> indegree;
 
+	// Grafo vacio, para llenarlo directamente (por ejemplo desde un archivo)
+	Graph() {}
+
 	// Constructor del grafo
 	Graph(vector<Edge> const& edges, int n) {
 		// redimensiona el vector para contener `n` elementos de tipo `vector<int>`
@@ -41,8 +57,279 @@ public:
 	}
 };
 
+// Posicion de lectura dentro de la lista de vecinos de un vrtice
+struct NeighborCursor {
+	size_t pos, end;
+
+	// ultimo vecino decodificado, base de la siguiente diferencia
+	int last;
+};
+
+// Grafo de solo lectura con listas de vecinos comprimidas
+// Cada lista se ordena y se guardan las diferencias entre vecinos consecutivos como varint (7 bits por byte)
+class CompressedGraph {
+public:
+	CompressedGraph() {}
+
+	// Comprime una lista de adyacencia
+	CompressedGraph(vector<vector<int>> const& adjList) {
+		for (auto const& neighbors : adjList) {
+			addVertex(neighbors);
+		}
+	}
+
+	// Agrega el siguiente vrtice con sus vecinos; los vecinos repetidos se descartan
+	void addVertex(vector<int> neighbors) {
+		sort(neighbors.begin(), neighbors.end());
+		neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+		int last = 0;
+		for (int w : neighbors) {
+			// la primera diferencia es el propio vecino; las siguientes son al menos 1
+			uint32_t gap = w - last;
+			last = w;
+			while (gap >= 0x80) {
+				data.push_back(uint8_t(gap | 0x80));
+				gap >>= 7;
+			}
+			data.push_back(uint8_t(gap));
+		}
+		offsets.push_back(data.size());
+		edges += neighbors.size();
+	}
+
+	// Cantidad de vrtices
+	int size() const {
+		return offsets.size() - 1;
+	}
+
+	// Cantidad de aristas
+	size_t edgeCount() const {
+		return edges;
+	}
+
+	// Bytes ocupados por las listas comprimidas y su indice
+	size_t memoryBytes() const {
+		return data.size() + offsets.size() * sizeof(size_t);
+	}
+
+	// Cursor al comienzo de los vecinos de `v`
+	NeighborCursor neighbors(int v) const {
+		return { offsets[v], offsets[v + 1], 0 };
+	}
+
+	// Decodifica el siguiente vecino en `w`; devuelve false si no quedan vecinos
+	bool next(NeighborCursor& cursor, int& w) const {
+		if (cursor.pos == cursor.end) {
+			return false;
+		}
+		uint32_t gap = 0;
+		int shift = 0;
+		uint8_t byte;
+		do {
+			byte = data[cursor.pos++];
+			gap |= uint32_t(byte & 0x7f) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+		cursor.last += gap;
+		w = cursor.last;
+		return true;
+	}
+
+private:
+	// bytes de todas las listas, una detras de otra
+	vector<uint8_t> data;
+
+	// los vecinos de `v` ocupan [offsets[v], offsets[v + 1]) dentro de `data`
+	vector<size_t> offsets = vector<size_t>(1, 0);
+
+	size_t edges = 0;
+};
+
+// Cantidad de vrtices, para los algoritmos que reciben cualquiera de los dos grafos
+int vertexCount(Graph const& graph) {
+	return graph.adjList.size();
+}
+
+int vertexCount(CompressedGraph const& graph) {
+	return graph.size();
+}
+
+// Cursor a los vecinos de `v`; en `Graph` la posicion es el indice dentro de adjList[v]
+NeighborCursor neighborsOf(Graph const& graph, int v) {
+	return { 0, graph.adjList[v].size(), 0 };
+}
+
+NeighborCursor neighborsOf(CompressedGraph const& graph, int v) {
+	return graph.neighbors(v);
+}
+
+// Avanza el cursor de `v` y deja el siguiente vecino en `w`; devuelve false al terminar
+bool nextNeighbor(Graph const& graph, int v, NeighborCursor& cursor, int& w) {
+	if (cursor.pos == cursor.end) {
+		return false;
+	}
+	w = graph.adjList[v][cursor.pos++];
+	return true;
+}
+
+bool nextNeighbor(CompressedGraph const& graph, int, NeighborCursor& cursor, int& w) {
+	return graph.next(cursor, w);
+}
+
+// Comprime el grafo vrtice por vrtice y libera cada lista apenas se codifica,
+// asi nunca estan completas a la vez la version comun y la comprimida
+CompressedGraph compressAndRelease(Graph& graph) {
+	CompressedGraph compressed;
+	for (auto& neighbors : graph.adjList) {
+		compressed.addVertex(move(neighbors));
+		vector<int>().swap(neighbors);
+	}
+	graph = Graph();
+	return compressed;
+}
+
+// Tabla de simbolos que asigna a cada nombre (asignatura o ciudad) un id entero consecutivo
+class SymbolTable {
+public:
+	// Agrega `name` y devuelve su id, o -1 si el nombre ya existia
+	int insert(string const& name) {
+		if (find(name) != -1) {
+			return -1;
+		}
+
+		// mantiene la tabla hash a lo sumo llena por la mitad
+		if (2 * (size() + 1) > (int)slots.size()) {
+			grow();
+		}
+
+		int id = size();
+		arena.append(name);
+		offsets.push_back(arena.size());
+		hashes.push_back(hashName(name));
+		place(id);
+		return id;
+	}
+
+	// Devuelve el id de `name`, o -1 si no existe
+	int find(string const& name) const {
+		if (slots.empty()) {
+			return -1;
+		}
+
+		size_t mask = slots.size() - 1;
+		uint32_t hash = hashName(name);
+		for (size_t slot = hash & mask; slots[slot] != -1; slot = (slot + 1) & mask) {
+			int id = slots[slot];
+			if (hashes[id] == hash && arena.compare(offsets[id], offsets[id + 1] - offsets[id], name) == 0) {
+				return id;
+			}
+		}
+		return -1;
+	}
+
+	// Devuelve el nombre del id
+	string name(int id) const {
+		return arena.substr(offsets[id], offsets[id + 1] - offsets[id]);
+	}
+
+	// Cantidad de nombres registrados
+	int size() const {
+		return offsets.size() - 1;
+	}
+
+	// Elimina el id y corre una posicion los ids mayores
+	void erase(int id) {
+		size_t length = offsets[id + 1] - offsets[id];
+		arena.erase(offsets[id], length);
+		offsets.erase(offsets.begin() + id + 1);
+		for (size_t i = id + 1; i < offsets.size(); i++) {
+			offsets[i] -= length;
+		}
+		hashes.erase(hashes.begin() + id);
+
+		// reubica los ids con los hashes guardados, sin volver a calcularlos
+		slots.assign(slots.size(), -1);
+		for (int i = 0; i < size(); i++) {
+			place(i);
+		}
+	}
+
+	// Elimina todos los nombres
+	void clear() {
+		arena.clear();
+		offsets.assign(1, 0);
+		hashes.clear();
+		slots.clear();
+	}
+
+private:
+	// caracteres de todos los nombres, uno detras de otro
+	string arena;
+
+	// el nombre `id` ocupa [offsets[id], offsets[id + 1]) dentro del arena
+	vector<size_t> offsets = vector<size_t>(1, 0);
+
+	// hash de cada nombre, para no recalcularlo al agrandar la tabla
+	vector<uint32_t> hashes;
+
+	// tabla hash de direccionamiento abierto (sondeo lineal): id o -1 si esta libre
+	vector<int> slots;
+
+	// hash FNV-1a del nombre
+	static uint32_t hashName(string const& name) {
+		uint32_t hash = 2166136261u;
+		for (unsigned char c : name) {
+			hash = (hash ^ c) * 16777619u;
+		}
+		return hash;
+	}
+
+	// ubica el id en el primer lugar libre a partir de su hash
+	void place(int id) {
+		size_t mask = slots.size() - 1;
+		size_t slot = hashes[id] & mask;
+		while (slots[slot] != -1) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = id;
+	}
+
+	// duplica la tabla (potencia de 2) y reubica todos los ids
+	void grow() {
+		slots.assign(max<size_t>(16, slots.size() * 2), -1);
+		for (int id = 0; id < size(); id++) {
+			place(id);
+		}
+	}
+};
+
+// Lee un nombre que todavia no este en la tabla, lo registra y devuelve su id
+int readNewName(SymbolTable& table, string& name) {
+	cin >> name;
+	int id = table.insert(name);
+	while (id == -1) {
+		cout << "El nombre " << name << " ya existe, ingrese otro: ";
+		cin >> name;
+		id = table.insert(name);
+	}
+	return id;
+}
+
+// Lee un nombre registrado en la tabla y devuelve su id; informa los nombres desconocidos
+int readExistingName(SymbolTable const& table, string& name) {
+	cin >> name;
+	int id = table.find(name);
+	while (id == -1) {
+		cout << "El nombre " << name << " no existe, ingrese otro: ";
+		cin >> name;
+		id = table.find(name);
+	}
+	return id;
+}
+
 // Funcion para imprimir la solucion del algoritmo de Floyd-Warshall
-void printSolution(int** dist, int V, int** local, string* nameLocations)
+void printSolution(int** dist, int V, int** local, SymbolTable const& nameLocations)
 {
 	cout << "La siguiente matriz muestra la distancia mas corta entre cada par de nodos " << endl;
 	for (int i = 0; i < V; i++) {
@@ -63,14 +350,14 @@ void printSolution(int** dist, int V, int** local, string* nameLocations)
 	for (int i = 0; i < V; i++) {
 		for (int j = 0; j < V; j++) {
 			aux = local[i][j];
-			cout << nameLocations[aux - 1] << " ";
+			cout << nameLocations.name(aux - 1) << " ";
 		}
 		cout << endl;
 	}
 }
 
 // Funcion para usar algoritmo de Floyd-Warshall
-void floydWarshall(int** dist, int V, int** local, string* nameLocations)
+void floydWarshall(int** dist, int V, int** local, SymbolTable const& nameLocations)
 {
 	int i, j, k;
 
@@ -93,7 +380,7 @@ void floydWarshall(int** dist, int V, int** local, string* nameLocations)
 }
 
 // Funcion para usar algoritmo de Dijkstra
-void dijkstra(int src, int finalNode, int** graph, int V, string* nameLocations) {
+void dijkstra(int src, int finalNode, int** graph, int V, SymbolTable const& nameLocations) {
 	// Declaracin de arrays necesarios para la lgica
 	int* finalDistance = new int[V];
 	bool* visited = new bool[V];
@@ -152,13 +439,13 @@ void dijkstra(int src, int finalNode, int** graph, int V, string* nameLocations)
 		for (int i = 0; i < V; i++) {
 			// Verificamos si la resta coincide con alguna distancia
 			if (recorridoTotal - graph[finalNode][i] == finalDistance[i]) {
-				cout << nameLocations[finalNode] << " <- ";
+				cout << nameLocations.name(finalNode) << " <- ";
 				recorridoTotal = finalDistance[i];
 				finalNode = i;
 			}
 		}
 	}
-	cout << nameLocations[src] << endl;
+	cout << nameLocations.name(src) << endl;
 	cout << "La distancia minima es: " << recorrido << endl;
 
 	// Liberar memoria
@@ -166,6 +453,371 @@ void dijkstra(int src, int finalNode, int** graph, int V, string* nameLocations)
 	delete[] visited;
 }
 
+// Arista con peso dentro de una lista de adyacencia
+struct WeightedEdge {
+	int dest, weight;
+};
+
+// Distancia de los nodos no alcanzados en los caminos minimos sobre listas; INF (99999) es
+// demasiado chico para los grafos cargados desde archivo
+const int unreachableDistance = numeric_limits<int>::max();
+
+// Caminos minimos desde un origen: distancia y predecesor de cada nodo (-1 si no tiene)
+struct ShortestPaths {
+	vector<int> distance;
+	vector<int> predecessor;
+};
+
+// Guarda `value` en `target` si es menor, de forma atomica; devuelve true si lo actualizo
+bool atomicMin(atomic<int>& target, int value) {
+	int current = target.load();
+	while (value < current) {
+		if (target.compare_exchange_weak(current, value)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Reparte el rango [0, count) entre `numThreads` hilos; `work` recibe (hilo, inicio, fin)
+template <class Work>
+void parallelFor(int count, int numThreads, Work work) {
+	if (numThreads <= 1 || count <= 1) {
+		work(0, 0, count);
+		return;
+	}
+
+	vector<thread> threads;
+	int chunk = (count + numThreads - 1) / numThreads;
+	for (int t = 0; t < numThreads; t++) {
+		int begin = t * chunk;
+		int end = min(count, begin + chunk);
+		if (begin >= end) {
+			break;
+		}
+		threads.emplace_back(work, t, begin, end);
+	}
+	for (auto& worker : threads) {
+		worker.join();
+	}
+}
+
+// Hilos de trabajo que se crean una sola vez y se reutilizan en cada fase
+// El hilo que llama a `run` trabaja como hilo 0 y espera a los demas antes de volver (barrera por fase)
+class WorkerPool {
+public:
+	// Rangos con menos elementos que esto se procesan en el hilo que llama
+	static const int minParallelCount = 256;
+
+	WorkerPool(int numThreads) : threadCount(max(1, numThreads)) {
+		for (int t = 1; t < threadCount; t++) {
+			workers.emplace_back(&WorkerPool::workerLoop, this, t);
+		}
+	}
+
+	~WorkerPool() {
+		{
+			lock_guard<mutex> lock(m);
+			stopping = true;
+		}
+		startPhase.notify_all();
+		for (auto& worker : workers) {
+			worker.join();
+		}
+	}
+
+	// Cantidad de hilos, incluido el que llama
+	int size() const {
+		return threadCount;
+	}
+
+	// Reparte el rango [0, count) entre los hilos; `work` recibe (hilo, inicio, fin)
+	void run(int count, function<void(int, int, int)> const& work) {
+		if (threadCount == 1 || count < minParallelCount) {
+			work(0, 0, count);
+			return;
+		}
+
+		{
+			lock_guard<mutex> lock(m);
+			task = &work;
+			taskCount = count;
+			pending = threadCount - 1;
+			generation++;
+		}
+		startPhase.notify_all();
+
+		runChunk(0);
+
+		unique_lock<mutex> lock(m);
+		phaseDone.wait(lock, [&] { return pending == 0; });
+		task = nullptr;
+	}
+
+private:
+	int threadCount;
+	vector<thread> workers;
+
+	mutex m;
+	condition_variable startPhase, phaseDone;
+	function<void(int, int, int)> const* task = nullptr;
+	int taskCount = 0;
+	int pending = 0;
+	long long generation = 0;
+	bool stopping = false;
+
+	// ejecuta la parte del rango que le toca al hilo `t`
+	void runChunk(int t) {
+		int chunk = (taskCount + threadCount - 1) / threadCount;
+		int begin = min(taskCount, t * chunk);
+		int end = min(taskCount, begin + chunk);
+		if (begin < end) {
+			(*task)(t, begin, end);
+		}
+	}
+
+	void workerLoop(int t) {
+		long long seen = 0;
+		while (true) {
+			{
+				unique_lock<mutex> lock(m);
+				startPhase.wait(lock, [&] { return stopping || generation != seen; });
+				if (stopping) {
+					return;
+				}
+				seen = generation;
+			}
+
+			runChunk(t);
+
+			lock_guard<mutex> lock(m);
+			if (--pending == 0) {
+				phaseDone.notify_one();
+			}
+		}
+	}
+};
+
+// Convierte la matriz de distancias (INF sin arista) en listas de adyacencia
+// Devuelve false si hay una distancia negativa, que delta-stepping no admite
+bool matrixToWeightedList(int** graph, int V, vector<vector<WeightedEdge>>& adj) {
+	adj.assign(V, vector<WeightedEdge>());
+	for (int i = 0; i < V; i++) {
+		for (int j = 0; j < V; j++) {
+			if (i == j || graph[i][j] == INF) {
+				continue;
+			}
+			if (graph[i][j] < 0) {
+				return false;
+			}
+			if (graph[i][j] > 0) {
+				adj[i].push_back({ j, graph[i][j] });
+			}
+		}
+	}
+	return true;
+}
+
+// Elige delta como el peso maximo dividido el grado promedio (al menos 1)
+int chooseDelta(vector<vector<WeightedEdge>> const& adj) {
+	long long edges = 0;
+	int maxWeight = 1;
+	for (auto const& list : adj) {
+		edges += list.size();
+		for (auto const& edge : list) {
+			maxWeight = max(maxWeight, edge.weight);
+		}
+	}
+	if (adj.empty() || edges == 0) {
+		return maxWeight;
+	}
+	long long averageDegree = max(1LL, edges / (long long)adj.size());
+	return max(1, (int)(maxWeight / averageDegree));
+}
+
+// Caminos minimos con delta-stepping en paralelo sobre los hilos de `pool`; requiere pesos positivos
+ShortestPaths deltaStepping(vector<vector<WeightedEdge>> const& adj, int src, int delta, WorkerPool& pool) {
+	int n = adj.size();
+	if (delta <= 0) {
+		delta = chooseDelta(adj);
+	}
+
+	vector<atomic<int>> dist(n);
+	for (int i = 0; i < n; i++) {
+		dist[i].store(unreachableDistance);
+	}
+	dist[src].store(0);
+
+	// buckets[i] contiene los nodos con distancia tentativa en [i * delta, (i + 1) * delta)
+	vector<vector<int>> buckets(1, vector<int>(1, src));
+
+	// marcas para no repetir nodos dentro de una misma fase
+	vector<int> inFrontier(n, -1), inSettled(n, -1);
+	int phase = 0;
+
+	// nodos mejorados por cada hilo durante una relajacion
+	vector<vector<int>> improved(pool.size());
+
+	// relaja las aristas livianas (peso <= delta) o pesadas de los nodos de `nodes`
+	auto relax = [&](vector<int> const& nodes, bool light) {
+		pool.run(nodes.size(), [&](int t, int begin, int end) {
+			for (int i = begin; i < end; i++) {
+				int u = nodes[i];
+				long long du = dist[u].load();
+				for (auto const& edge : adj[u]) {
+					long long candidate = du + edge.weight;
+					if ((edge.weight <= delta) == light && candidate < unreachableDistance && atomicMin(dist[edge.dest], (int)candidate)) {
+						improved[t].push_back(edge.dest);
+					}
+				}
+			}
+		});
+
+		// ubica los nodos mejorados en el bucket de su nueva distancia
+		for (auto& list : improved) {
+			for (int v : list) {
+				size_t b = dist[v].load() / delta;
+				if (b >= buckets.size()) {
+					buckets.resize(b + 1);
+				}
+				buckets[b].push_back(v);
+			}
+			list.clear();
+		}
+	};
+
+	for (size_t i = 0; i < buckets.size(); i++) {
+		vector<int> settled;
+
+		// las aristas livianas pueden volver a llenar el bucket actual
+		while (!buckets[i].empty()) {
+			vector<int> frontier;
+			for (int v : buckets[i]) {
+				// descarta entradas viejas (el nodo ya bajo de bucket) y repetidas
+				if ((size_t)(dist[v].load() / delta) == i && inFrontier[v] != phase) {
+					inFrontier[v] = phase;
+					frontier.push_back(v);
+					if (inSettled[v] != (int)i) {
+						inSettled[v] = i;
+						settled.push_back(v);
+					}
+				}
+			}
+			buckets[i].clear();
+			phase++;
+			relax(frontier, true);
+		}
+
+		// con el bucket cerrado, las aristas pesadas se relajan una sola vez
+		relax(settled, false);
+	}
+
+	ShortestPaths result;
+	result.distance.resize(n);
+	for (int i = 0; i < n; i++) {
+		result.distance[i] = dist[i].load();
+	}
+
+	// el predecesor de `v` es el menor `u` con dist[u] + peso == dist[v], asi el arbol no depende de los hilos
+	vector<atomic<int>> predecessor(n);
+	for (int i = 0; i < n; i++) {
+		predecessor[i].store(numeric_limits<int>::max());
+	}
+	pool.run(n, [&](int, int begin, int end) {
+		for (int u = begin; u < end; u++) {
+			if (result.distance[u] == unreachableDistance) {
+				continue;
+			}
+			for (auto const& edge : adj[u]) {
+				if (edge.dest != src && (long long)result.distance[u] + edge.weight == result.distance[edge.dest]) {
+					atomicMin(predecessor[edge.dest], u);
+				}
+			}
+		}
+	});
+	result.predecessor.resize(n);
+	for (int i = 0; i < n; i++) {
+		int p = predecessor[i].load();
+		result.predecessor[i] = p == numeric_limits<int>::max() ? -1 : p;
+	}
+
+	return result;
+}
+
+// Distancias minimas con Dijkstra secuencial (cola de prioridad), referencia para delta-stepping
+vector<int> sequentialDistances(vector<vector<WeightedEdge>> const& adj, int src) {
+	vector<int> dist(adj.size(), unreachableDistance);
+	priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pending;
+
+	dist[src] = 0;
+	pending.push({ 0, src });
+	while (!pending.empty()) {
+		int d = pending.top().first;
+		int u = pending.top().second;
+		pending.pop();
+		if (d > dist[u]) {
+			continue;
+		}
+		for (auto const& edge : adj[u]) {
+			if ((long long)d + edge.weight < dist[edge.dest]) {
+				dist[edge.dest] = d + edge.weight;
+				pending.push({ dist[edge.dest], edge.dest });
+			}
+		}
+	}
+	return dist;
+}
+
+// Mide delta-stepping con 1 a N hilos frente a Dijkstra secuencial, verificando cada resultado
+// Cada WorkerPool se crea fuera de la medicion, asi el tiempo no incluye el arranque de los hilos
+void benchmarkDeltaStepping(vector<vector<WeightedEdge>> const& adj, int src, int delta, int maxThreads) {
+	cout << "Delta utilizado: " << delta << endl;
+	auto start = chrono::steady_clock::now();
+	vector<int> reference = sequentialDistances(adj, src);
+	double baseTime = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+	cout << "Dijkstra secuencial  Tiempo: " << baseTime << " ms" << endl;
+
+	for (int t = 1; t <= maxThreads; t++) {
+		WorkerPool pool(t);
+		start = chrono::steady_clock::now();
+		ShortestPaths run = deltaStepping(adj, src, delta, pool);
+		double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		cout << "Hilos: " << t << "  Tiempo: " << ms << " ms  Aceleracion: " << (ms > 0 ? baseTime / ms : 1.0);
+		cout << (run.distance == reference ? "  (distancias coinciden)" : "  (distancias distintas)") << endl;
+	}
+}
+
+// Funcion para usar delta-stepping en lugar de Dijkstra; opcionalmente mide la escalabilidad de 1 a N hilos
+void deltaSteppingMode(int src, int finalNode, int** graph, int V, SymbolTable const& nameLocations, bool benchmark) {
+	vector<vector<WeightedEdge>> adj;
+	if (!matrixToWeightedList(graph, V, adj)) {
+		cout << "Error: delta-stepping requiere distancias positivas y se ingresaron distancias negativas" << endl;
+		return;
+	}
+	int delta = chooseDelta(adj);
+	int maxThreads = max(1u, thread::hardware_concurrency());
+
+	WorkerPool pool(maxThreads);
+	ShortestPaths paths = deltaStepping(adj, src, delta, pool);
+
+	// Imprimir recorrido
+	if (paths.distance[finalNode] == unreachableDistance) {
+		cout << "No hay recorrido entre " << nameLocations.name(src) << " y " << nameLocations.name(finalNode) << endl;
+	}
+	else {
+		cout << "Recorrido: ";
+		for (int v = finalNode; v != src; v = paths.predecessor[v]) {
+			cout << nameLocations.name(v) << " <- ";
+		}
+		cout << nameLocations.name(src) << endl;
+		cout << "La distancia minima es: " << paths.distance[finalNode] << endl;
+	}
+
+	if (benchmark) {
+		benchmarkDeltaStepping(adj, src, delta, maxThreads);
+	}
+}
+
 // Funcin para realizar un ordenamiento topolgico en un DAG dado
 vector<int> doTopologicalSort(Graph const& graph) {
 	vector<int> L;
@@ -212,74 +864,588 @@ vector<int> doTopologicalSort(Graph const& graph) {
 	return L;
 }
 
+// Componentes fuertemente conexas de un grafo dirigido y su grafo condensado (DAG)
+struct Condensation {
+	// componente de cada vrtice; los ids de componente siguen un orden topologico
+	vector<int> component;
+
+	// vrtices que forman cada componente
+	vector<vector<int>> members;
+
+	// aristas entre componentes distintas, sin repetir
+	vector<Edge> edges;
+
+	// verdadero si la componente forma un ciclo (varios vrtices o un vrtice con arista a si mismo)
+	vector<bool> cyclic;
+};
+
+// Calcula las componentes fuertemente conexas con Tarjan iterativo en O(V + E)
+template <class G>
+Condensation findStronglyConnectedComponents(G const& graph) {
+	int n = vertexCount(graph);
+
+	Condensation result;
+	result.component.assign(n, -1);
+
+	// orden de descubrimiento y menor orden alcanzable de cada vrtice
+	vector<int> order(n, -1);
+	vector<int> low(n, 0);
+	vector<bool> onStack(n, false);
+	vector<int> stack;
+
+	// pila de llamadas explicita: vrtice y cursor al siguiente vecino a visitar
+	vector<pair<int, NeighborCursor>> callStack;
+	int counter = 0;
+
+	// Tarjan encuentra las componentes en orden topologico inverso
+	vector<vector<int>> found;
+
+	for (int s = 0; s < n; s++) {
+		if (order[s] != -1) {
+			continue;
+		}
+
+		order[s] = low[s] = counter++;
+		stack.push_back(s);
+		onStack[s] = true;
+		callStack.push_back({ s, neighborsOf(graph, s) });
+
+		while (!callStack.empty()) {
+			int v = callStack.back().first;
+			int w;
+
+			if (nextNeighbor(graph, v, callStack.back().second, w)) {
+				if (order[w] == -1) {
+					// desciende a un vrtice no visitado
+					order[w] = low[w] = counter++;
+					stack.push_back(w);
+					onStack[w] = true;
+					callStack.push_back({ w, neighborsOf(graph, w) });
+				}
+				else if (onStack[w] && order[w] < low[v]) {
+					low[v] = order[w];
+				}
+				continue;
+			}
+
+			// terminaron los vecinos de `v`: propaga `low` al padre
+			callStack.pop_back();
+			if (!callStack.empty()) {
+				int parent = callStack.back().first;
+				if (low[v] < low[parent]) {
+					low[parent] = low[v];
+				}
+			}
+
+			// `v` es raiz de una componente: la extrae de la pila
+			if (low[v] == order[v]) {
+				vector<int> members;
+				int w;
+				do {
+					w = stack.back();
+					stack.pop_back();
+					onStack[w] = false;
+					members.push_back(w);
+				} while (w != v);
+				found.push_back(members);
+			}
+		}
+	}
+
+	// numera las componentes en orden topologico
+	int c = found.size();
+	result.members.resize(c);
+	for (int i = 0; i < c; i++) {
+		int id = c - 1 - i;
+		for (int v : found[i]) {
+			result.component[v] = id;
+		}
+		result.members[id] = found[i];
+	}
+
+	// agrega las aristas del grafo condensado, evitando repetidas, y marca las componentes con ciclo
+	vector<int> lastSource(c, -1);
+	result.cyclic.resize(c);
+	for (int id = 0; id < c; id++) {
+		result.cyclic[id] = result.members[id].size() > 1;
+	}
+	for (int id = 0; id < c; id++) {
+		for (int v : result.members[id]) {
+			NeighborCursor cursor = neighborsOf(graph, v);
+			int w;
+			while (nextNeighbor(graph, v, cursor, w)) {
+				int target = result.component[w];
+				if (target == id) {
+					result.cyclic[id] = true;
+				}
+				else if (lastSource[target] != id) {
+					lastSource[target] = id;
+					result.edges.push_back({ id, target });
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+// Imprime el orden topologico o, si hay ciclos, las asignaturas que los forman y el orden por grupos
+void printSubjectOrder(Graph const& graph, vector<int> const& L, SymbolTable const& subjectTable) {
+	if (L.size()) {
+		for (int i : L) {
+			cout << subjectTable.name(i) << " --> ";
+		}
+		cout << "Fin" << endl;
+		return;
+	}
+
+	cout << "El orden topologico no es posible" << endl;
+
+	Condensation condensation = findStronglyConnectedComponents(graph);
+	int c = condensation.members.size();
+	for (int id = 0; id < c; id++) {
+		if (condensation.cyclic[id]) {
+			cout << "Las siguientes asignaturas forman un ciclo: ";
+			for (int i : condensation.members[id]) {
+				cout << subjectTable.name(i) << " ";
+			}
+			cout << endl;
+		}
+	}
+
+	// los ids de componente ya siguen un orden topologico del grafo condensado
+	cout << "Orden por grupos: " << endl;
+	for (int id = 0; id < c; id++) {
+		auto const& members = condensation.members[id];
+		if (!condensation.cyclic[id]) {
+			cout << subjectTable.name(members[0]) << " --> ";
+			continue;
+		}
+		cout << "[ ";
+		for (int i : members) {
+			cout << subjectTable.name(i) << " ";
+		}
+		cout << "] --> ";
+	}
+	cout << "Fin" << endl;
+}
+
+// Indice de clausura transitiva de las asignaturas, guardado como bitsets de 64 bits por palabra
+struct PrerequisiteIndex {
+	// successors[v] marca las asignaturas que requieren a `v` (directa o indirectamente)
+	vector<vector<uint64_t>> successors;
+
+	// predecessors[v] marca las asignaturas que `v` requiere (directa o indirectamente)
+	vector<vector<uint64_t>> predecessors;
+
+	// cantidad de asignaturas indexadas
+	int n = 0;
+
+	// falso si el grafo tiene un ciclo y no hay orden topologico
+	bool valid = false;
+};
+
+// Cantidad de palabras de 64 bits necesarias para `n` bits
+int bitsetWords(int n) {
+	return (n + 63) / 64;
+}
+
+// Marca el bit `i` del bitset
+void setBit(vector<uint64_t>& bits, int i) {
+	bits[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+// Consulta el bit `i` del bitset
+bool testBit(vector<uint64_t> const& bits, int i) {
+	return (bits[i / 64] >> (i % 64)) & 1;
+}
+
+// Posicion del bit encendido mas bajo de `word` (distinto de 0)
+int lowestBit(uint64_t word) {
+#ifdef _MSC_VER
+	unsigned long bit;
+	_BitScanForward64(&bit, word);
+	return bit;
+#else
+	return __builtin_ctzll(word);
+#endif
+}
+
+// Llama a `visit(i)` por cada bit encendido del bitset, en orden creciente
+template <class Visit>
+void forEachBit(vector<uint64_t> const& bits, Visit visit) {
+	for (size_t w = 0; w < bits.size(); w++) {
+		uint64_t word = bits[w];
+		while (word) {
+			visit(int(w * 64) + lowestBit(word));
+			word &= word - 1;
+		}
+	}
+}
+
+// Realiza `dest |= src` palabra por palabra
+void orBits(vector<uint64_t>& dest, vector<uint64_t> const& src) {
+	for (size_t w = 0; w < src.size(); w++) {
+		dest[w] |= src[w];
+	}
+}
+
+// Construye el indice de clausura transitiva a partir del orden topologico `L`
+void buildPrerequisiteIndex(Graph const& graph, vector<int> const& L, PrerequisiteIndex& index) {
+	int n = graph.adjList.size();
+	int words = bitsetWords(n);
+
+	index.n = n;
+	index.successors.assign(n, vector<uint64_t>(words, 0));
+	index.predecessors.assign(n, vector<uint64_t>(words, 0));
+
+	// sin orden topologico (ciclo) el indice no es valido
+	index.valid = (int)L.size() == n;
+	if (!index.valid) {
+		return;
+	}
+
+	// en orden topologico inverso cada nodo une los sucesores de sus vecinos
+	for (int i = n - 1; i >= 0; i--) {
+		int u = L[i];
+		for (int v : graph.adjList[u]) {
+			setBit(index.successors[u], v);
+			orBits(index.successors[u], index.successors[v]);
+		}
+	}
+
+	// en orden topologico cada vecino hereda los predecesores del nodo
+	for (int u : L) {
+		for (int v : graph.adjList[u]) {
+			setBit(index.predecessors[v], u);
+			orBits(index.predecessors[v], index.predecessors[u]);
+		}
+	}
+}
+
+// Agrega al indice una nueva asignatura (sin sucesores) con sus dependencias directas
+void addSubjectToIndex(PrerequisiteIndex& index, vector<int> const& dependencies) {
+	int newSubject = index.n;
+	index.n++;
+	int words = bitsetWords(index.n);
+
+	// agranda los bitsets si la nueva asignatura no entra en la ultima palabra
+	for (auto& bits : index.successors) {
+		bits.resize(words, 0);
+	}
+	for (auto& bits : index.predecessors) {
+		bits.resize(words, 0);
+	}
+	index.successors.push_back(vector<uint64_t>(words, 0));
+	index.predecessors.push_back(vector<uint64_t>(words, 0));
+
+	if (!index.valid) {
+		return;
+	}
+
+	// los predecesores de la nueva asignatura son sus dependencias y los predecesores de estas
+	vector<uint64_t>& pred = index.predecessors[newSubject];
+	for (int d : dependencies) {
+		// una asignatura que depende de si misma forma un ciclo
+		if (d == newSubject) {
+			index.valid = false;
+			return;
+		}
+		setBit(pred, d);
+		orBits(pred, index.predecessors[d]);
+	}
+
+	// cada predecesor pasa a tener a la nueva asignatura como sucesora
+	forEachBit(pred, [&](int p) {
+		setBit(index.successors[p], newSubject);
+	});
+}
+
+// Indica si la asignatura `x` es requisito (directo o indirecto) de la asignatura `y`
+bool isPrerequisite(PrerequisiteIndex const& index, int x, int y) {
+	return testBit(index.successors[x], y);
+}
+
+// Devuelve todos los requisitos (directos o indirectos) de la asignatura `y`
+vector<int> getPrerequisites(PrerequisiteIndex const& index, int y) {
+	vector<int> result;
+	forEachBit(index.predecessors[y], [&](int p) {
+		result.push_back(p);
+	});
+	return result;
+}
+
 // Funcin para agregar una nueva asignatura
-void addSubject(vector<Edge>& subjects, string subjectName, vector<string>& subjectNames, int& totalSubjects) {
+void addSubject(vector<Edge>& subjects, string subjectName, int& totalSubjects, PrerequisiteIndex& index, SymbolTable& subjectTable) {
 	int numDependencies;
 
+	if (subjectTable.insert(subjectName) == -1) {
+		cout << "La asignatura " << subjectName << " ya existe" << endl;
+		return;
+	}
+
 	cout << "Ingrese el numero de dependencias para la asignatura " << subjectName << ": ";
 	cin >> numDependencies;
 
 	// Agrega la nueva asignatura
-	subjectNames.push_back(subjectName);
 	totalSubjects++;
 
 	// Agrega dependencias
+	vector<int> dependencies;
 	for (int j = 0; j < numDependencies; j++) {
 		cout << "Ingrese la dependencia " << j + 1 << " para la asignatura " << subjectName << ": ";
 		string dependency;
-		cin >> dependency;
 		// Encuentra el ndice de la asignatura
-		int k = 0;
-		while (subjectNames[k] != dependency) {
-			k++;
-		}
+		int k = readExistingName(subjectTable, dependency);
 		Edge edge = { k, totalSubjects - 1 };
 		subjects.push_back(edge);
+		dependencies.push_back(k);
 	}
 
+	// Actualiza el indice de requisitos sin reconstruirlo
+	addSubjectToIndex(index, dependencies);
+
 	// Crea un nuevo grafo con las asignaturas actualizadas
 	Graph graph(subjects, totalSubjects);
 	vector<int> L = doTopologicalSort(graph);
 
 	// Imprime el orden topolgico
 	cout << "El orden de las asignaturas es el siguiente: " << endl;
-	if (L.size()) {
-		for (int i : L) {
-			cout << subjectNames[i] << " --> ";
+	printSubjectOrder(graph, L, subjectTable);
+}
+
+// Datos de una carga de lista de aristas
+struct EdgeListStats {
+	size_t bytes = 0;
+	size_t edges = 0;
+
+	// lineas que no son "origen destino" (o "origen destino peso") validos
+	size_t malformed = 0;
+	double seconds = 0;
+
+	// motivo por el que la carga fallo
+	string error;
+};
+
+// Lee un entero no negativo menor que INT_MAX desde `p` (asi id + 1 entra en un int)
+// Devuelve false si no hay un numero antes del fin de linea o si el numero es demasiado grande
+bool parseNumber(const char*& p, const char* end, int& value) {
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+		p++;
+	}
+	if (p == end || *p < '0' || *p > '9') {
+		return false;
+	}
+	const int limit = numeric_limits<int>::max() - 1;
+	value = 0;
+	while (p < end && *p >= '0' && *p <= '9') {
+		int digit = *p - '0';
+		if (value > (limit - digit) / 10) {
+			return false;
 		}
-		cout << "Fin" << endl;
+		value = value * 10 + digit;
+		p++;
 	}
-	else {
-		cout << "El orden topologico no es posible" << endl;
+	return true;
+}
+
+// Recorre las aristas "origen destino" de las lineas en [begin, end) y llama a `visit(origen, destino, peso)`
+// Con `weighted` cada linea debe traer un peso entero >= 1 en la tercera columna; sin pesos se pasa peso 1
+// Las lineas vacias y las que empiezan con '#' o '%' se ignoran; devuelve la cantidad de lineas mal formadas
+template <class Visit>
+size_t parseEdgeLines(const char* begin, const char* end, bool weighted, Visit visit) {
+	size_t malformed = 0;
+	const char* p = begin;
+	while (p < end) {
+		while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+			p++;
+		}
+
+		int src, dest, weight = 1;
+		if (p < end && *p != '\n' && *p != '#' && *p != '%') {
+			if (parseNumber(p, end, src) && parseNumber(p, end, dest) && (!weighted || (parseNumber(p, end, weight) && weight >= 1))) {
+				visit(src, dest, weight);
+			}
+			else {
+				malformed++;
+			}
+		}
+
+		// pasa a la siguiente linea (ignora las columnas sobrantes)
+		while (p < end && *p != '\n') {
+			p++;
+		}
+		p++;
 	}
+	return malformed;
 }
 
-// Funcin para realizar el Recorrido en Profundidad (DFS)
-void DFS(vector<vector<int>>& grafo, vector<bool>& visitado, int nodoActual) {
-	visitado[nodoActual] = true;
-	cout << "Visitando nodo: " << nodoActual << endl;
+// Guarda el vecino en la lista: solo el destino, o el destino con su peso
+inline void setNeighbor(int& slot, int dest, int) {
+	slot = dest;
+}
+
+inline void setNeighbor(WeightedEdge& slot, int dest, int weight) {
+	slot = { dest, weight };
+}
+
+// Carga un archivo de lista de aristas en `adjList` usando `numThreads` hilos
+// El texto se parte en bloques que terminan en salto de linea y se recorre tres veces en paralelo:
+// mayor id, grados en un unico arreglo atomico compartido y llenado de las listas, sin copiar a un vector<Edge>
+// El orden de los vecinos dentro de cada lista depende del reparto entre hilos; `indegree` puede ser nullptr
+template <class Neighbor>
+bool loadEdgeLists(string const& path, int numThreads, bool weighted, vector<vector<Neighbor>>& adjList, vector<int>* indegree, EdgeListStats& stats) {
+	auto start = chrono::steady_clock::now();
+
+	ifstream file(path, ios::binary);
+	if (!file) {
+		stats.error = "no se pudo abrir el archivo";
+		return false;
+	}
+	file.seekg(0, ios::end);
+
+	// tellg falla (-1) o devuelve un tamao sin sentido si la ruta no es un archivo regular (por ejemplo un directorio)
+	streamoff end = file.tellg();
+	if (end < 0 || (unsigned long long)end >= string().max_size()) {
+		stats.error = "no es un archivo regular";
+		return false;
+	}
+	size_t size = end;
+	file.seekg(0, ios::beg);
+	string buffer(size, '\0');
+	if (!file.read(&buffer[0], size) || (size_t)file.gcount() != size) {
+		stats.error = "no se pudo leer el archivo completo";
+		return false;
+	}
+
+	// limites de los bloques, corridos hasta el siguiente salto de linea
+	numThreads = max(1, numThreads);
+	const char* text = buffer.data();
+	vector<size_t> bounds(numThreads + 1, size);
+	bounds[0] = 0;
+	for (int t = 1; t < numThreads; t++) {
+		size_t b = max(bounds[t - 1], size * t / numThreads);
+		while (b < size && b > 0 && text[b - 1] != '\n') {
+			b++;
+		}
+		bounds[t] = b;
+	}
+
+	// primera pasada: mayor id de vrtice, aristas y lineas mal formadas por bloque
+	vector<int> maxId(numThreads, -1);
+	vector<size_t> edgeCount(numThreads, 0), malformed(numThreads, 0);
+	parallelFor(numThreads, numThreads, [&](int t, int, int) {
+		malformed[t] = parseEdgeLines(text + bounds[t], text + bounds[t + 1], weighted, [&](int src, int dest, int) {
+			maxId[t] = max(maxId[t], max(src, dest));
+			edgeCount[t]++;
+		});
+	});
+
+	int n = *max_element(maxId.begin(), maxId.end()) + 1;
+	stats.edges = 0;
+	stats.malformed = 0;
+	for (int t = 0; t < numThreads; t++) {
+		stats.edges += edgeCount[t];
+		stats.malformed += malformed[t];
+	}
+
+	try {
+		// segunda pasada: grados de salida y de entrada en un unico arreglo compartido
+		vector<atomic<int>> outdegree(n);
+		{
+			vector<atomic<int>> indegreeCount(indegree ? n : 0);
+			parallelFor(n, numThreads, [&](int, int begin, int end) {
+				for (int v = begin; v < end; v++) {
+					outdegree[v].store(0, memory_order_relaxed);
+					if (indegree) {
+						indegreeCount[v].store(0, memory_order_relaxed);
+					}
+				}
+			});
+			parallelFor(numThreads, numThreads, [&](int t, int, int) {
+				parseEdgeLines(text + bounds[t], text + bounds[t + 1], weighted, [&](int src, int dest, int) {
+					outdegree[src].fetch_add(1, memory_order_relaxed);
+					if (indegree) {
+						indegreeCount[dest].fetch_add(1, memory_order_relaxed);
+					}
+				});
+			});
+
+			if (indegree) {
+				indegree->assign(n, 0);
+				for (int v = 0; v < n; v++) {
+					(*indegree)[v] = indegreeCount[v].load(memory_order_relaxed);
+				}
+			}
+		}
 
-	for (int nodoAdyacente = 0; nodoAdyacente < grafo.size(); ++nodoAdyacente) {
-		if (grafo[nodoActual][nodoAdyacente] == 1 && !visitado[nodoAdyacente]) {
-			DFS(grafo, visitado, nodoAdyacente);
+		// reserva cada lista con su tamao final; outdegree pasa a ser el cursor de escritura
+		adjList.assign(n, vector<Neighbor>());
+		parallelFor(n, numThreads, [&](int, int begin, int end) {
+			for (int v = begin; v < end; v++) {
+				adjList[v].resize(outdegree[v].load(memory_order_relaxed));
+				outdegree[v].store(0, memory_order_relaxed);
+			}
+		});
+
+		// tercera pasada: cada hilo escribe sus aristas en la posicion que reserva con el cursor atomico
+		parallelFor(numThreads, numThreads, [&](int t, int, int) {
+			parseEdgeLines(text + bounds[t], text + bounds[t + 1], weighted, [&](int src, int dest, int weight) {
+				setNeighbor(adjList[src][outdegree[src].fetch_add(1, memory_order_relaxed)], dest, weight);
+			});
+		});
+	}
+	catch (bad_alloc const&) {
+		vector<vector<Neighbor>>().swap(adjList);
+		if (indegree) {
+			vector<int>().swap(*indegree);
 		}
+		stats.error = "no hay memoria suficiente para " + to_string(n) + " vertices y " + to_string(stats.edges) + " aristas";
+		return false;
 	}
+
+	stats.bytes = size;
+	stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return true;
 }
 
-// Funcion para verficiar conectividad
-void Conexo(vector<vector<int>>& grafo, vector<bool>& visitado, int nodoActual, vector<int>& componente) {
-	visitado[nodoActual] = true;
-	componente.push_back(nodoActual);
+// Carga un archivo "origen destino" por linea en `graph`, con sus grados de entrada
+bool loadEdgeListFile(string const& path, int numThreads, Graph& graph, EdgeListStats& stats) {
+	return loadEdgeLists(path, numThreads, false, graph.adjList, &graph.indegree, stats);
+}
+
+// Carga un archivo "origen destino peso" por linea en listas con pesos para delta-stepping
+bool loadWeightedEdgeListFile(string const& path, int numThreads, vector<vector<WeightedEdge>>& adj, EdgeListStats& stats) {
+	return loadEdgeLists(path, numThreads, true, adj, (vector<int>*)nullptr, stats);
+}
 
-	for (int nodoAdyacente = 0; nodoAdyacente < grafo.size(); ++nodoAdyacente) {
-		if (grafo[nodoActual][nodoAdyacente] == 1 && !visitado[nodoAdyacente]) {
-			Conexo(grafo, visitado, nodoAdyacente, componente);
+// Funcin para realizar el Recorrido en Profundidad (DFS), decodificando los vecinos sobre la marcha
+void DFS(CompressedGraph const& grafo, int nodoInicio) {
+	vector<bool> visitado(grafo.size(), false);
+
+	// pila explicita con el cursor de vecinos de cada nodo, en lugar de recursion
+	vector<pair<int, NeighborCursor>> pila;
+
+	visitado[nodoInicio] = true;
+	cout << "Visitando nodo: " << nodoInicio << endl;
+	pila.push_back({ nodoInicio, grafo.neighbors(nodoInicio) });
+
+	while (!pila.empty()) {
+		int nodoAdyacente;
+		if (!grafo.next(pila.back().second, nodoAdyacente)) {
+			pila.pop_back();
+			continue;
+		}
+		if (!visitado[nodoAdyacente]) {
+			visitado[nodoAdyacente] = true;
+			cout << "Visitando nodo: " << nodoAdyacente << endl;
+			pila.push_back({ nodoAdyacente, grafo.neighbors(nodoAdyacente) });
 		}
 	}
 }
 
-// Funcin para realizar el Recorrido en Amplitud (BFS)
-void BFS(vector<vector<int>>& grafo, int nodoInicio) {
+// Funcin para realizar el Recorrido en Amplitud (BFS), decodificando los vecinos sobre la marcha
+void BFS(CompressedGraph const& grafo, int nodoInicio) {
 	vector<bool> visitado(grafo.size(), false);
 	queue<int> cola;
 
@@ -291,8 +1457,10 @@ void BFS(vector<vector<int>>& grafo, int nodoInicio) {
 		cola.pop();
 		cout << "Visitando nodo: " << nodoActual << endl;
 
-		for (int nodoAdyacente = 0; nodoAdyacente < grafo.size(); ++nodoAdyacente) {
-			if (grafo[nodoActual][nodoAdyacente] == 1 && !visitado[nodoAdyacente]) {
+		NeighborCursor cursor = grafo.neighbors(nodoActual);
+		int nodoAdyacente;
+		while (grafo.next(cursor, nodoAdyacente)) {
+			if (!visitado[nodoAdyacente]) {
 				visitado[nodoAdyacente] = true;
 				cola.push(nodoAdyacente);
 			}
@@ -311,6 +1479,7 @@ int main() {
 	cout << "4. Usar recorridos de amplitud y profundidad (BSP) (DSP)" << endl;
 	cout << "5. Verficiar conectividad del grafo" << endl;
 	cout << "6. Usar recorrido por conectividad" << endl;
+	cout << "7. Cargar grafo desde archivo (lista de aristas)" << endl;
 	cout << "9. Salir" << endl;
 	cin >> selector;
 
@@ -323,28 +1492,21 @@ int main() {
 	// Variables case 1
 	int nodes = 0, auxNumber = 0;
 	bool correct = true;
-	string* nameLocations = new string[nodes];
+	SymbolTable cityTable;
 
 	// Variables case 2
-	int finalNode = 0, src = 0;
+	int finalNode = 0, src = 0, mode = 0;
 	int** graphCase2 = new int* [nodes];
 
 	// Variables case 3
 	vector<Edge> subjects;
 	int totalSubjects, numDependencies = 0;
-	//Definir subjectNames
-	vector<string> subjectNames;
 	vector<int> L;
+	PrerequisiteIndex prerequisiteIndex;
+	SymbolTable subjectTable;
 
 	// Variables case 4
-	vector<vector<int>> graph(nodes, vector<int>(nodes, 0));
 	int firstNode;
-	vector<bool> visitedDFS(nodes, false);
-
-	// Variables case 5
-	vector<bool> visited(nodes, false);
-	vector<vector<int>> connectedComponents;
-	vector<vector<int>> connectivityGraph(nodes, vector<int>(nodes, 0));
 
 	while (seguir) {
 
@@ -377,11 +1539,12 @@ int main() {
 				locations[i] = new int[nodes];
 			}
 
-			nameLocations = new string[nodes];
+			cityTable.clear();
 			for (i = 0; i < nodes; i++) 
 			{
+				string cityName;
 				cout << "Ingrese el nombre de la ciudad " << i + 1 << endl;
-				cin >> nameLocations[i];
+				readNewName(cityTable, cityName);
 			}
 
 			// Inicializacion de la matriz de recorrido
@@ -431,7 +1594,7 @@ int main() {
 					matrix[i][j] = auxNumber;
 				}
 			}
-			floydWarshall(matrix, nodes, locations, nameLocations);
+			floydWarshall(matrix, nodes, locations, cityTable);
 			break;
 		}
 		case 2:
@@ -448,16 +1611,18 @@ int main() {
 			}
 
 			// Declaracion de la matriz
+			graphCase2 = new int* [nodes];
 			for (i = 0; i < nodes; i++)
 			{
 				graphCase2[i] = new int[nodes];
 			}
 
-			nameLocations = new string[nodes];
+			cityTable.clear();
 			for (i = 0; i < nodes; i++) 
 			{
+				string cityName;
 				cout << "Ingrese el nombre de la ciudad " << i + 1 << endl;
-				cin >> nameLocations[i];
+				readNewName(cityTable, cityName);
 			}
 
 			// Inicializar matriz con valores 0
@@ -479,7 +1644,7 @@ int main() {
 						if (graphCase2[i][j] == 0)
 						{
 							int distancia;
-							cout << "Ingrese la distancia entre el nodo " << nameLocations[i] << " y el nodo " << nameLocations[j] << ": ";
+							cout << "Ingrese la distancia entre el nodo " << cityTable.name(i) << " y el nodo " << cityTable.name(j) << ": ";
 							cin >> distancia;
 							while (cin.fail()) {
 								cin.clear();
@@ -504,24 +1669,41 @@ int main() {
 
 			// Imprimir grafo
 
-			cout << "Indica el indice de tu nodo raiz" << endl;
-			cin >> src;
-			while (cin.fail()) {
-				cin.clear();
-				cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Se ignora toda la entrada anterior hasta encontrar un salto de linea  
-				cout << "Ingrese una opcion valida: ";
-				cin >> src;
+			{
+				string cityName;
+				cout << "Indica el nombre de la ciudad raiz" << endl;
+				src = readExistingName(cityTable, cityName);
+				cout << "Indica el nombre de la ciudad final" << endl;
+				finalNode = readExistingName(cityTable, cityName);
 			}
-			cout << "Indica el indice del nodo final" << endl;
-			cin >> finalNode;
-			while (cin.fail()) {
+
+			cout << "1. Usar Dijkstra" << endl;
+			cout << "2. Usar delta-stepping en paralelo" << endl;
+			cin >> mode;
+			while (cin.fail() || (mode != 1 && mode != 2)) {
 				cin.clear();
 				cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Se ignora toda la entrada anterior hasta encontrar un salto de linea  
-				cout << "Ingrese una opcion valida: ";
-				cin >> finalNode;
+				cout << "Ingrese una opcion valida: 1 o 2";
+				cin >> mode;
 			}
 
-			dijkstra(src, finalNode, graphCase2, nodes, nameLocations);
+			if (mode == 1)
+			{
+				dijkstra(src, finalNode, graphCase2, nodes, cityTable);
+			}
+			else
+			{
+				int benchmark;
+				cout << "Ingrese 1 para medir la escalabilidad de 1 a N hilos, 0 para omitirla: ";
+				cin >> benchmark;
+				while (cin.fail()) {
+					cin.clear();
+					cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Se ignora toda la entrada anterior hasta encontrar un salto de linea  
+					cout << "Ingrese una opcion valida: ";
+					cin >> benchmark;
+				}
+				deltaSteppingMode(src, finalNode, graphCase2, nodes, cityTable, benchmark == 1);
+			}
 			break;
 		}
 		case 3:
@@ -535,17 +1717,19 @@ int main() {
 				cout << "Ingrese una opcion valida: ";
 				cin >> totalSubjects;
 			}
-			subjectNames.resize(totalSubjects);
+			subjectTable.clear();
+			subjects.clear();
 
 			// Array dinmico para asignaturas
 			for (i = 0; i < totalSubjects; i++) {
 				cout << "Ingrese el nombre de la asignatura " << i + 1 << ": ";
-				cin >> subjectNames[i];
+				string subjectName;
+				readNewName(subjectTable, subjectName);
 			}
 
 			// Inicializa las dependencias de las asignaturas
 			for (int i = 0; i < totalSubjects; i++) {
-				cout << "Ingrese el numero de dependencias para la asignatura " << subjectNames[i] << ": ";
+				cout << "Ingrese el numero de dependencias para la asignatura " << subjectTable.name(i) << ": ";
 				cin >> numDependencies;
 				while (cin.fail()) {
 					cin.clear();
@@ -554,14 +1738,10 @@ int main() {
 					cin >> numDependencies;
 				}
 				for (int j = 0; j < numDependencies; j++) {
-					cout << "Ingrese la dependencia " << j + 1 << " para la asignatura " << subjectNames[i] << ": ";
+					cout << "Ingrese la dependencia " << j + 1 << " para la asignatura " << subjectTable.name(i) << ": ";
 					string dependency;
-					cin >> dependency;
 					// Encuentra el ndice de la asignatura
-					int k = 0;
-					while (subjectNames[k] != dependency) {
-						k++;
-					}
+					int k = readExistingName(subjectTable, dependency);
 					Edge edge = { k, i };
 					subjects.push_back(edge);
 				}
@@ -573,23 +1753,20 @@ int main() {
 			// Realiza el ordenamiento topolgico
 			L = doTopologicalSort(graph);
 
+			// Construye el indice de requisitos a partir del orden topologico
+			buildPrerequisiteIndex(graph, L, prerequisiteIndex);
+
 			// Imprime el orden topolgico
 			cout << "El orden de las asignaturas es el siguiente: " << endl;
-			if (L.size()) {
-				for (int i : L) {
-					cout << subjectNames[i] << " --> ";
-				}
-				cout << "Fin" << endl;
-			}
-			else {
-				cout << "El orden topologico no es posible" << endl;
-			}
+			printSubjectOrder(graph, L, subjectTable);
 
 			// Opcin para agregar y eliminar asignaturas
 
 			while (true) {
 				cout << "Ingrese 1 para agregar una asignatura" << endl;
 				cout << "Ingrese 2 para eliminar una asignatura" << endl;
+				cout << "Ingrese 3 para consultar si una asignatura es requisito de otra" << endl;
+				cout << "Ingrese 4 para listar los requisitos de una asignatura" << endl;
 				cout << "Ingrese 0 para salir " << endl;
 				cin >> selector;
 
@@ -604,19 +1781,15 @@ int main() {
 					string subjectName;
 					cout << "Ingrese el nombre de la asignatura: ";
 					cin >> subjectName;
-					addSubject(subjects, subjectName, subjectNames, totalSubjects);
+					addSubject(subjects, subjectName, totalSubjects, prerequisiteIndex, subjectTable);
 				}
 				else if (selector == 2) 
 				{
 					string subjectName;
 					cout << "Ingrese el nombre de la asignatura para eliminar: ";
-					cin >> subjectName;
 					// Encuentra el ndice de la asignatura
-					k = 0;
-					while (subjectNames[k] != subjectName) {
-						k++;
-					}
-					subjectNames.erase(subjectNames.begin() + k);
+					k = readExistingName(subjectTable, subjectName);
+					subjectTable.erase(k);
 					totalSubjects--;
 					// Reconstruye el grafo despus de eliminar la asignatura
 					vector<Edge> updatedSubjects;
@@ -631,19 +1804,44 @@ int main() {
 					subjects = updatedSubjects;
 					Graph graph(subjects, totalSubjects);
 					L = doTopologicalSort(graph);
+					buildPrerequisiteIndex(graph, L, prerequisiteIndex);
 					// Imprime el orden topolgico
 					cout << "El orden de las asignaturas despus de eliminar es el siguiente: " << endl;
-					if (L.size()) 
+					printSubjectOrder(graph, L, subjectTable);
+				}
+				else if (selector == 3 || selector == 4)
+				{
+					if (!prerequisiteIndex.valid)
 					{
-						for (int i : L) 
+						cout << "Las asignaturas forman un ciclo, no se pueden consultar requisitos" << endl;
+						continue;
+					}
+					string subjectName;
+					cout << "Ingrese el nombre de la asignatura: ";
+					// Encuentra el ndice de la asignatura
+					int y = readExistingName(subjectTable, subjectName);
+					if (selector == 3)
+					{
+						string prerequisiteName;
+						cout << "Ingrese el nombre del posible requisito: ";
+						int x = readExistingName(subjectTable, prerequisiteName);
+						if (isPrerequisite(prerequisiteIndex, x, y))
 						{
-							cout << subjectNames[i] << " --> ";
+							cout << prerequisiteName << " es requisito de " << subjectName << endl;
+						}
+						else
+						{
+							cout << prerequisiteName << " no es requisito de " << subjectName << endl;
 						}
-						cout << "Fin" << endl;
 					}
-					else 
+					else
 					{
-						cout << "El orden topologico no es posible" << endl;
+						cout << "Requisitos de " << subjectName << ": ";
+						for (int p : getPrerequisites(prerequisiteIndex, y))
+						{
+							cout << subjectTable.name(p) << " ";
+						}
+						cout << endl;
 					}
 				}
 				else if (selector == 0) 
@@ -665,25 +1863,34 @@ int main() {
 				cin >> nodes;
 			}
 
-			// Inicializacin de la matriz de adyacencia
+			// Lectura de la matriz de adyacencia: cada fila se comprime apenas se termina de leer,
+			// sin guardar la matriz completa; los recorridos decodifican los vecinos sobre la marcha
 			cout << "Ingrese la matriz de adyacencia del grafo (0 o 1):" << endl;;
-			graph.resize(nodes, vector<int>(nodes, 0));
-			visitedDFS.resize(nodes, false);
+			CompressedGraph compressedGraph;
+			vector<int> row;
 			for (int i = 0; i < nodes; ++i) 
 			{
+				row.clear();
 				for (int j = 0; j < nodes; ++j) 
 				{
+					int value;
 					cout << "Indique el valor correspondiente al" << i + 1 << "," << j + 1 << endl;
-					cin >> graph[i][j];
-					while (graph[i][j] != 1 || graph[i][j] != 0) 
+					cin >> value;
+					while (cin.fail() || (value != 1 && value != 0)) 
 					{
 						cin.clear();
 						cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Se ignora toda la entrada anterior hasta encontrar un salto de linea  
 						cout << "Ingrese una opcion valida: 1 o 0";
-						cin >> graph[i][j];
+						cin >> value;
+					}
+					if (value == 1)
+					{
+						row.push_back(j);
 					}
 				}
+				compressedGraph.addVertex(row);
 			}
+			cout << "Grafo comprimido: " << compressedGraph.edgeCount() << " aristas en " << compressedGraph.memoryBytes() << " bytes" << endl;
 
 			cout << "Ingrese el nodo de inicio para el recorrido: ";
 			cin >> firstNode;
@@ -699,23 +1906,23 @@ int main() {
 			cout << "1. Si desea ver recorrido por profundidad (DSF)" << endl;
 			cout << "2. Si desea ver recorrido por amplitud (BSF)" << endl;
 			cin >> selector;
-			while (selector != 1 || selector != 2) 
+			while (cin.fail() || (selector != 1 && selector != 2)) 
 			{
 				cin.clear();
 				cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Se ignora toda la entrada anterior hasta encontrar un salto de linea  
-				cout << "Ingrese una opcion valida: 1 o 0";
+				cout << "Ingrese una opcion valida: 1 o 2";
 				cin >> selector;
 			}
 
 			if (selector == 1) 
 			{
 				cout << "Recorrido en Profundidad (DFS):" << endl;
-				DFS(graph, visitedDFS, firstNode);
+				DFS(compressedGraph, firstNode);
 			}
 			else 
 			{
 				cout << endl << "Recorrido en Amplitud (BFS):" << endl;
-				BFS(graph, firstNode);
+				BFS(compressedGraph, firstNode);
 			}
 			
 			break;
@@ -731,40 +1938,176 @@ int main() {
 				cout << "Ingrese una opcion valida: ";
 				cin >> nodes;
 			}
-			connectivityGraph.resize(nodes, vector<int>(nodes, 0));
 			cout << "Ingrese la matriz de adyacencia del grafo (0 o 1):\n";
 
+			// Cada fila se comprime apenas se lee; el grafo se recorre en O(V + E)
+			CompressedGraph connectivity;
+			vector<int> row;
 			for (int i = 0; i < nodes; ++i)
 			{
+				row.clear();
 				for (int j = 0; j < nodes; ++j) 
 				{
+					int value;
 					cout << "Indique el valor correspondiente al" << i + 1 << "," << j + 1 << endl;
-					cin >> connectivityGraph[i][j];
+					cin >> value;
+					if (value == 1)
+					{
+						row.push_back(j);
+					}
 				}
+				connectivity.addVertex(row);
 			}
 
-			visited.resize(nodes, false);
-			
-			for (int nodo = 0; nodo < nodes; ++nodo) 
+			Condensation condensation = findStronglyConnectedComponents(connectivity);
+
+			cout << "Componentes Fuertemente Conexas : " << endl;
+			for (size_t i = 0; i < condensation.members.size(); ++i) 
+			{
+				cout << "Componente " << i + 1 << ": ";
+				for (size_t j = 0; j < condensation.members[i].size(); ++j) 
+				{
+					cout << condensation.members[i][j] << " ";
+				}
+				cout << endl;
+			}
+			if (condensation.members.size() == 1)
 			{
-				if (!visited[nodo]) {
-					vector<int> componenteActual;
-					Conexo(connectivityGraph, visited, nodo, componenteActual);
-					connectedComponents.push_back(componenteActual);
+				cout << "El grafo es fuertemente conexo" << endl;
+			}
+			break;
+		}
+		case 7:
+		{
+			int fileMode = 0;
+			while (fileMode != 1 && fileMode != 2)
+			{
+				cout << "1. Grafo sin pesos (componentes fuertemente conexas)" << endl;
+				cout << "2. Grafo con pesos (caminos minimos con delta-stepping)" << endl;
+				cin >> fileMode;
+				if (cin.fail())
+				{
+					cin.clear();
+					cin.ignore(numeric_limits<streamsize>::max(), '\n');
+					fileMode = 0;
 				}
 			}
 
-			cout << "Componentes Conexas : " << endl;
-			for (int i = 0; i < connectedComponents.size(); ++i) 
+			string path;
+			int numThreads = max(1u, thread::hardware_concurrency());
+			if (fileMode == 2)
 			{
-				cout << "Componente " << i + 1 << ": ";
-				for (int j = 0; j < connectedComponents[i].size(); ++j) 
+				cout << "Ingrese la ruta del archivo (una arista \"origen destino peso\" por linea, peso >= 1): ";
+				cin >> path;
+
+				vector<vector<WeightedEdge>> weightedFile;
+				EdgeListStats stats;
+				if (!loadWeightedEdgeListFile(path, numThreads, weightedFile, stats))
 				{
-					cout << connectedComponents[i][j] << " ";
+					cout << "No se pudo cargar el archivo " << path << ": " << stats.error << endl;
+					break;
 				}
-				cout << endl;
+
+				double megabytes = stats.bytes / (1024.0 * 1024.0);
+				int vertices = weightedFile.size();
+				cout << "Vertices: " << vertices << "  Aristas: " << stats.edges << endl;
+				if (stats.malformed)
+				{
+					cout << "Lineas mal formadas ignoradas: " << stats.malformed << endl;
+				}
+				cout << "Hilos: " << numThreads << "  Tiempo: " << stats.seconds * 1000 << " ms  Velocidad: "
+					<< (stats.seconds > 0 ? megabytes / stats.seconds : 0) << " MB/s" << endl;
+				if (vertices == 0)
+				{
+					break;
+				}
+
+				int src = -1;
+				while (src < 0 || src >= vertices)
+				{
+					cout << "Ingrese el vertice de origen (0 a " << vertices - 1 << "): ";
+					cin >> src;
+					if (cin.fail())
+					{
+						cin.clear();
+						cin.ignore(numeric_limits<streamsize>::max(), '\n');
+						src = -1;
+					}
+				}
+
+				int delta = chooseDelta(weightedFile);
+				WorkerPool pool(numThreads);
+				auto start = chrono::steady_clock::now();
+				ShortestPaths paths = deltaStepping(weightedFile, src, delta, pool);
+				double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+				int reached = 0, farthest = 0;
+				for (int v = 0; v < vertices; v++)
+				{
+					if (paths.distance[v] != unreachableDistance)
+					{
+						reached++;
+						farthest = max(farthest, paths.distance[v]);
+					}
+				}
+				cout << "Vertices alcanzados: " << reached << "  Distancia maxima: " << farthest << endl;
+				cout << "Delta-stepping  Hilos: " << numThreads << "  Delta: " << delta << "  Tiempo: " << ms << " ms" << endl;
+
+				int benchmark = -1;
+				while (benchmark != 0 && benchmark != 1)
+				{
+					cout << "Ingrese 1 para medir la escalabilidad de 1 a N hilos, 0 para omitirla: ";
+					cin >> benchmark;
+					if (cin.fail())
+					{
+						cin.clear();
+						cin.ignore(numeric_limits<streamsize>::max(), '\n');
+						benchmark = -1;
+					}
+				}
+				if (benchmark == 1)
+				{
+					benchmarkDeltaStepping(weightedFile, src, delta, numThreads);
+				}
+				break;
 			}
 
+			cout << "Ingrese la ruta del archivo (una arista \"origen destino\" por linea): ";
+			cin >> path;
+
+			Graph fileGraph;
+			EdgeListStats stats;
+			if (!loadEdgeListFile(path, numThreads, fileGraph, stats))
+			{
+				cout << "No se pudo cargar el archivo " << path << ": " << stats.error << endl;
+				break;
+			}
+
+			double megabytes = stats.bytes / (1024.0 * 1024.0);
+			cout << "Vertices: " << fileGraph.adjList.size() << "  Aristas: " << stats.edges << endl;
+			if (stats.malformed)
+			{
+				cout << "Lineas mal formadas ignoradas: " << stats.malformed << endl;
+			}
+			cout << "Hilos: " << numThreads << "  Tiempo: " << stats.seconds * 1000 << " ms  Velocidad: "
+				<< (stats.seconds > 0 ? megabytes / stats.seconds : 0) << " MB/s" << endl;
+
+			// Comprime el grafo liberando cada lista sin comprimir; los recorridos usan la copia comprimida
+			size_t plainBytes = fileGraph.adjList.size() * (sizeof(vector<int>) + sizeof(int)) + stats.edges * sizeof(int);
+			CompressedGraph compressedFile = compressAndRelease(fileGraph);
+			cout << "Memoria: " << plainBytes << " bytes sin comprimir, " << compressedFile.memoryBytes() << " bytes comprimido" << endl;
+
+			Condensation condensation = findStronglyConnectedComponents(compressedFile);
+			cout << "Componentes fuertemente conexas: " << condensation.members.size() << endl;
+			if (find(condensation.cyclic.begin(), condensation.cyclic.end(), true) == condensation.cyclic.end())
+			{
+				cout << "El grafo no tiene ciclos, el orden topologico es posible" << endl;
+			}
+			else
+			{
+				cout << "El grafo tiene ciclos, el orden topologico no es posible" << endl;
+			}
+			break;
 		}
 		}
 
@@ -783,6 +2126,7 @@ int main() {
 			cout << "4. Usar recorrido en profundidad" << endl;
 			cout << "5. Usar recorrido por amplitud" << endl;
 			cout << "6. Usar recorrido por conectividad" << endl;
+			cout << "7. Cargar grafo desde archivo (lista de aristas)" << endl;
 			cout << "9. Salir" << endl;
 			cin >> selector;
 			while (selector > 9 || selector < 1) {